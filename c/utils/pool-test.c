@@ -0,0 +1,73 @@
+#include "pool.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+
+int                   main(void)
+{
+  poolHead*           pool;
+  void*               elts[10];
+  void*               tmp;
+  int                 i;
+
+  /*
+   * Test 1
+   */
+
+  /* Create pool */
+  assert(NULL != (pool = poolCreate(sizeof(int), 4)));
+  assert(1    == pool->nbSlab);                   /* First slab is ready */
+  assert(sizeof(void*) <= pool->eltSize);         /* Room for free link  */
+
+  /* Fill the first slab */
+  for (i = 0; i < 4; ++i)
+    assert(NULL != (elts[i] = poolAlloc(pool)));  /* Carve 4 elements */
+  assert(1    == pool->nbSlab);
+
+  /* Elements are contiguous inside a slab */
+  assert((char*) elts[1] == (char*) elts[0] + pool->eltSize);
+
+  /* Go past the first slab */
+  assert(NULL != (elts[4] = poolAlloc(pool)));
+  assert(2    == pool->nbSlab);                   /* New slab */
+
+  /* Released elements are reused first */
+  poolRelease(pool, elts[2]);
+  poolRelease(pool, elts[0]);
+  assert(elts[0] == (tmp = poolAlloc(pool)));     /* LIFO free list */
+  assert(elts[2] == (tmp = poolAlloc(pool)));
+  assert(2    == pool->nbSlab);                   /* No new slab */
+
+  /* Clear the pool */
+  poolFree(pool);
+
+  printf("Pool: Test1 success!\n");
+
+  /*
+   * Test 2
+   */
+
+  /* Degenerate sizes are accepted */
+  assert(NULL != (pool = poolCreate(1, 0)));
+  for (i = 0; i < 10; ++i)
+  {
+    assert(NULL != (elts[i] = poolAlloc(pool)));
+    *(char*) elts[i] = i;
+  }
+  assert(10   == pool->nbSlab);                   /* One element per slab */
+
+  for (i = 0; i < 10; ++i)
+    poolRelease(pool, elts[i]);
+
+  for (i = 9; i >= 0; --i)
+    assert(elts[i] == poolAlloc(pool));           /* Everything is reused */
+  assert(10   == pool->nbSlab);
+
+  /* Clear the pool */
+  poolFree(pool);
+
+  printf("Pool: Test2 success!\n");
+
+  return 0;
+}
@@ -0,0 +1,106 @@
+#include "pool.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <err.h>
+
+
+static void           poolGrow(poolHead*                     pool)
+{
+  poolSlab*           slab;
+
+  if (!(slab = malloc(sizeof(poolSlab)
+                      + (size_t) pool->eltSize * pool->nbEltPerSlab)))
+    errx(EXIT_FAILURE, "ERROR: Cannot allocate memory for pool slab");
+
+  slab->next    = pool->slabs;
+  pool->slabs   = slab;
+  pool->nbSlab += 1;
+
+  /* Elements are carved lazily so a fresh slab is never walked */
+  pool->cursor  = (char*) (slab + 1);
+  pool->end     = pool->cursor + (size_t) pool->eltSize * pool->nbEltPerSlab;
+}
+
+poolHead*             poolCreate(unsigned int                eltSize,
+                                 unsigned int                nbEltPerSlab)
+{
+  poolHead*           result;
+
+  if (!(result = malloc(sizeof(poolHead))))
+    errx(EXIT_FAILURE, "ERROR: Cannot allocate memory for pool head");
+
+  memset(result, 0, sizeof(poolHead));
+
+  if (eltSize < sizeof(poolFreeElt))
+    eltSize = sizeof(poolFreeElt);
+
+  /* Keep every element pointer aligned */
+  eltSize = (eltSize + sizeof(void*) - 1) & ~(sizeof(void*) - 1);
+
+  result->eltSize      = eltSize;
+  result->nbEltPerSlab = (!nbEltPerSlab) ? 1 : nbEltPerSlab;
+
+  poolGrow(result);
+
+  return result;
+}
+
+void*                 poolAlloc(poolHead*                    pool)
+{
+  poolFreeElt*        result;
+
+  if (!pool)
+    errx(EXIT_FAILURE, "ERROR: NULL pool");
+
+  if (!!pool->freeList)
+  {
+    result         = pool->freeList;
+    pool->freeList = result->next;
+
+    return result;
+  }
+
+  if (pool->cursor == pool->end)
+    poolGrow(pool);
+
+  result        = (poolFreeElt*) pool->cursor;
+  pool->cursor += pool->eltSize;
+
+  return result;
+}
+
+void                  poolRelease(poolHead*                  pool,
+                                  void*                      elt)
+{
+  poolFreeElt*        tmp;
+
+  if (!pool)
+    errx(EXIT_FAILURE, "ERROR: NULL pool");
+
+  if (!elt)
+    return;
+
+  tmp            = elt;
+  tmp->next      = pool->freeList;
+  pool->freeList = tmp;
+}
+
+void                  poolFree(poolHead*                     pool)
+{
+  poolSlab*           tmp;
+
+  if (!pool)
+    errx(EXIT_FAILURE, "ERROR: NULL pool");
+
+  while (!!pool->slabs)
+  {
+    tmp         = pool->slabs;
+    pool->slabs = tmp->next;
+
+    free(tmp);
+  }
+
+  memset(pool, 0, sizeof(poolHead));
+  free(pool);
+}
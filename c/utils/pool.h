@@ -0,0 +1,72 @@
+#ifndef UTILS__POOL_H_
+# define UTILS__POOL_H_
+
+/**
+ ** Structure
+ */
+typedef struct                   poolSlab
+{
+  struct poolSlab*               next;
+}                                poolSlab;
+
+typedef struct                   poolFreeElt
+{
+  struct poolFreeElt*            next;
+}                                poolFreeElt;
+
+typedef struct                   poolHead
+{
+  struct poolSlab*               slabs;
+  struct poolFreeElt*            freeList;
+  char*                          cursor;
+  char*                          end;
+  unsigned int                   eltSize;
+  unsigned int                   nbEltPerSlab;
+  unsigned int                   nbSlab;
+}                                poolHead;
+
+
+/**
+ ** Methods
+ */
+
+/**
+ ** Create a new pool of fixed size elements.
+ ** The first slab is allocated immediately.
+ **
+ ** \param  eltSize       Size of one element.
+ ** \param  nbEltPerSlab  Number of elements carved from each slab.
+ **
+ ** \return An initialized pool structure or NULL.
+ */
+poolHead*             poolCreate(unsigned int                eltSize,
+                                 unsigned int                nbEltPerSlab);
+
+/**
+ ** Get an element from the pool, allocating a new slab if needed.
+ **
+ ** \param  pool        The pool object.
+ **
+ ** \return An uninitialized element.
+ */
+void*                 poolAlloc(poolHead*                    pool);
+
+/**
+ ** Give an element back to the pool free list.
+ **
+ ** \param  pool        The pool object.
+ ** \param  elt         The element to release.
+ */
+void                  poolRelease(poolHead*                  pool,
+                                  void*                      elt);
+
+/**
+ ** Free a pool object and all of its slabs at once.
+ ** Elements handed out by the pool become invalid.
+ **
+ ** \param  pool        The pool object.
+ */
+void                  poolFree(poolHead*                     pool);
+
+
+#endif /* UTILS__POOL_H_ */
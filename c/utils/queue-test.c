@@ -91,5 +91,34 @@ int                   main(void)
 
   printf("Queue: Test2 success!\n");
 
+  /*
+   * Test 3
+   */
+
+  /* Create pooled queue */
+  assert(NULL != (queue = queueCreatePooled(2)));
+
+  /* Fill the queue past the first slab */
+  assert(1    == (queueAdd(queue, &i1)));      /* Insert 1 */
+  assert(1    == (queueAdd(queue, &i2)));      /* Insert 2 */
+  assert(1    == (queueAdd(queue, &i3)));      /* Insert 3 */
+  assert(2    == queue->pool->nbSlab);         /* Second slab */
+
+  /* Check the queue */
+  assert(1    == (*(int*)queueRemove(queue))); /* Remove 1 */
+  assert(2    == (*(int*)queueRemove(queue))); /* Remove 2 */
+  assert(1    == (queueAdd(queue, &i4)));      /* Insert 4 */
+  assert(1    == (queueAdd(queue, &i1)));      /* Insert 1 */
+  assert(2    == queue->pool->nbSlab);         /* Nodes are recycled */
+
+  assert(3    == (*(int*)queueRemove(queue))); /* Remove 3 */
+  assert(4    == (*(int*)queueFirst(queue)));  /* Check  4 */
+  assert(4    == (*(int*)queueRemove(queue))); /* Remove 4 */
+
+  /* Clear a non empty queue */
+  queueFree(queue);
+
+  printf("Queue: Test3 success!\n");
+
   return 0;
 }
@@ -5,6 +5,28 @@
 #include <err.h>
 
 
+static queueElt*      queueEltAlloc(queueHead*               queue)
+{
+  queueElt*           result;
+
+  if (!!queue->pool)
+    return poolAlloc(queue->pool);
+
+  if (!(result = malloc(sizeof(queueElt))))
+    errx(EXIT_FAILURE, "ERROR: Cannot allocate memory for queue element");
+
+  return result;
+}
+
+static void           queueEltRelease(queueHead*             queue,
+                                      queueElt*              elt)
+{
+  if (!!queue->pool)
+    poolRelease(queue->pool, elt);
+  else
+    free(elt);
+}
+
 queueHead*            queueCreate(void)
 {
   queueHead*          result;
@@ -17,6 +39,16 @@ queueHead*            queueCreate(void)
   return result;
 }
 
+queueHead*            queueCreatePooled(unsigned int         initialCapacity)
+{
+  queueHead*          result;
+
+  result       = queueCreate();
+  result->pool = poolCreate(sizeof(queueElt), initialCapacity);
+
+  return result;
+}
+
 int                   queueAdd(queueHead*                    queue,
                                void*                         elt)
 {
@@ -25,8 +57,7 @@ int                   queueAdd(queueHead*                    queue,
   if (!queue)
     errx(EXIT_FAILURE, "ERROR: NULL queue");
 
-  if (!(newElt = malloc(sizeof(queueElt))))
-    errx(EXIT_FAILURE, "ERROR: Cannot allocate memory for queue element");
+  newElt = queueEltAlloc(queue);
 
   newElt->data = elt;
   newElt->next = NULL;
@@ -36,6 +67,7 @@ int                   queueAdd(queueHead*                    queue,
     if (queue->last != queue->first)
     {
       warnx("ERROR: Invalid state for queue");
+      queueEltRelease(queue, newElt);
       return 0;
     }
 
@@ -75,7 +107,7 @@ void*                 queueRemove(queueHead*                 queue)
     queue->nbElt    = 0;
   }
 
-  free(tmp);
+  queueEltRelease(queue, tmp);
 
   return result;
 }
@@ -96,6 +128,12 @@ void                  queueFree(queueHead*                   queue)
   if (!queue)
     errx(EXIT_FAILURE, "ERROR: NULL queue");
 
+  if (!!queue->pool) /* Slabs are released at once */
+  {
+    poolFree(queue->pool);
+    queue->first = NULL;
+  }
+
   while (!!queue->first)
   {
     queue->last  = queue->first;
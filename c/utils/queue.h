@@ -1,6 +1,8 @@
 #ifndef UTILS__QUEUE_H_
 # define UTILS__QUEUE_H_
 
+# include "pool.h"
+
 /**
  ** Structure
  */
@@ -15,6 +17,7 @@ typedef struct                   queueHead
   struct queueElt*               first;
   struct queueElt*               last;
   unsigned int                   nbElt;
+  struct poolHead*               pool;
 }                                queueHead;
 
 
@@ -29,6 +32,17 @@ typedef struct                   queueHead
  */
 queueHead*            queueCreate(void);
 
+/**
+ ** Create a new queue object whose elements are taken from a private pool.
+ ** Nodes are carved from slabs and recycled through the pool free list,
+ ** and queueFree() gives back whole slabs at once.
+ **
+ ** \param  initialCapacity Number of nodes per slab.
+ **
+ ** \return An initialized queue structure or NULL.
+ */
+queueHead*            queueCreatePooled(unsigned int         initialCapacity);
+
 /**
  ** Add a new element to an existing queue.
  **
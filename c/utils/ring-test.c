@@ -0,0 +1,133 @@
+#include "ring.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+
+int                   main(void)
+{
+  ringHead*           ring;
+  int                 i1 = 1;
+  int                 i2 = 2;
+  int                 i3 = 3;
+  int                 i4 = 4;
+
+  /*
+   * Test 1
+   */
+
+  /* Create ring */
+  assert(NULL != (ring = ringCreate(0)));
+
+  /* Fill the ring */
+  assert(1    == (ringAdd(ring, &i1)));      /* Insert 1 */
+  assert(1    == (ringAdd(ring, &i2)));      /* Insert 2 */
+  assert(1    == (ringAdd(ring, &i3)));      /* Insert 3 */
+  assert(1    == (ringAdd(ring, &i4)));      /* Insert 4 */
+
+  /* Check the ring */
+  assert(1    == (*(int*)ringFirst(ring)));  /* Check  1 */
+  assert(1    == (*(int*)ringRemove(ring))); /* Remove 1 */
+  assert(2    == (*(int*)ringFirst(ring)));  /* Check  2 */
+  assert(2    == (*(int*)ringRemove(ring))); /* Remove 2 */
+  assert(3    == (*(int*)ringFirst(ring)));  /* Check  3 */
+  assert(3    == (*(int*)ringRemove(ring))); /* Remove 3 */
+  assert(4    == (*(int*)ringFirst(ring)));  /* Check  4 */
+  assert(4    == (*(int*)ringRemove(ring))); /* Remove 4 */
+
+  assert(NULL == (ringFirst(ring)));         /* Check empty    */
+  assert(NULL == (ringRemove(ring)));        /* Ring is empty  */
+
+  /* Clear the ring */
+  ringFree(ring);
+
+  printf("Ring: Test1 success!\n");
+
+  /*
+   * Test 2
+   */
+
+  /* Create ring */
+  assert(NULL != (ring = ringCreate(0)));
+
+  /* Fill the ring */
+  assert(1    == (ringAdd(ring, &i1)));      /* Insert 1 */
+  assert(1    == (*(int*)ringRemove(ring))); /* Remove 1 */
+
+  assert(1    == (ringAdd(ring, &i1)));      /* Insert 1 */
+  assert(1    == (ringAdd(ring, &i2)));      /* Insert 2 */
+  assert(1    == (*(int*)ringRemove(ring))); /* Remove 1 */
+  assert(2    == (*(int*)ringRemove(ring))); /* Remove 2 */
+
+  assert(1    == (ringAdd(ring, &i1)));      /* Insert 1 */
+  assert(1    == (*(int*)ringFirst(ring)));  /* Check  1 */
+  assert(1    == (ringAdd(ring, &i2)));      /* Insert 2 */
+  assert(1    == (*(int*)ringRemove(ring))); /* Remove 1 */
+  assert(1    == (ringAdd(ring, &i3)));      /* Insert 3 */
+  assert(2    == (*(int*)ringRemove(ring))); /* Remove 2 */
+  assert(1    == (ringAdd(ring, &i4)));      /* Insert 4 */
+
+  assert(3    == (*(int*)ringRemove(ring))); /* Remove 3 */
+  assert(4    == (*(int*)ringRemove(ring))); /* Remove 4 */
+
+  /* Fill the ring */
+  assert(1    == (ringAdd(ring, &i1)));      /* Insert 1 */
+  assert(1    == (ringAdd(ring, &i2)));      /* Insert 2 */
+  assert(1    == (ringAdd(ring, &i3)));      /* Insert 3 */
+  assert(1    == (ringAdd(ring, &i4)));      /* Insert 4 */
+
+  /* Check the ring */
+  assert(1    == (*(int*)ringRemove(ring))); /* Remove 1 */
+  assert(2    == (*(int*)ringFirst(ring)));  /* Check  2 */
+  assert(2    == (*(int*)ringRemove(ring))); /* Remove 2 */
+  assert(3    == (*(int*)ringRemove(ring))); /* Remove 3 */
+  assert(4    == (*(int*)ringRemove(ring))); /* Remove 4 */
+
+  assert(NULL == (ringFirst(ring)));         /* Check empty    */
+  assert(NULL == (ringRemove(ring)));        /* Ring is empty  */
+
+  /* Clear the ring */
+  ringFree(ring);
+
+  printf("Ring: Test2 success!\n");
+
+  /*
+   * Test 3
+   */
+
+  /* Create a small ring */
+  assert(NULL != (ring = ringCreate(3)));
+  assert(3    == ring->mask);                /* Rounded up to 4 */
+
+  /* Move the head so the content wraps */
+  assert(1    == (ringAdd(ring, &i1)));      /* Insert 1 */
+  assert(1    == (ringAdd(ring, &i2)));      /* Insert 2 */
+  assert(1    == (ringAdd(ring, &i3)));      /* Insert 3 */
+  assert(1    == (*(int*)ringRemove(ring))); /* Remove 1 */
+  assert(2    == (*(int*)ringRemove(ring))); /* Remove 2 */
+  assert(1    == (ringAdd(ring, &i4)));      /* Insert 4 */
+  assert(1    == (ringAdd(ring, &i1)));      /* Insert 1 */
+  assert(1    == (ringAdd(ring, &i2)));      /* Insert 2 */
+  assert(4    == ring->nbElt);               /* Full and wrapped */
+
+  /* Grow a wrapped ring */
+  assert(1    == (ringAdd(ring, &i3)));      /* Insert 3 */
+  assert(7    == ring->mask);                /* Doubled */
+
+  /* Check the ring */
+  assert(3    == (*(int*)ringRemove(ring))); /* Remove 3 */
+  assert(4    == (*(int*)ringRemove(ring))); /* Remove 4 */
+  assert(1    == (*(int*)ringRemove(ring))); /* Remove 1 */
+  assert(2    == (*(int*)ringFirst(ring)));  /* Check  2 */
+  assert(2    == (*(int*)ringRemove(ring))); /* Remove 2 */
+  assert(3    == (*(int*)ringRemove(ring))); /* Remove 3 */
+
+  assert(NULL == (ringRemove(ring)));        /* Ring is empty  */
+
+  /* Clear the ring */
+  ringFree(ring);
+
+  printf("Ring: Test3 success!\n");
+
+  return 0;
+}
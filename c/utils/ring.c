@@ -0,0 +1,116 @@
+#include "ring.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <err.h>
+
+
+static void           ringGrow(ringHead*                     ring)
+{
+  void**              elts;
+  unsigned int        capacity;
+  unsigned int        head;
+  unsigned int        split;
+
+  capacity = (ring->mask + 1) << 1;
+  if (!capacity)
+    errx(EXIT_FAILURE, "ERROR: Ring capacity overflow");
+
+  if (!(elts = malloc(capacity * sizeof(void*))))
+    errx(EXIT_FAILURE, "ERROR: Cannot allocate memory for ring elements");
+
+  /* Unwrap the old content at the start of the new array */
+  head  = ring->head & ring->mask;
+  split = ring->mask + 1 - head;
+  if (split > ring->nbElt)
+    split = ring->nbElt;
+
+  memcpy(elts, ring->elts + head, split * sizeof(void*));
+  memcpy(elts + split, ring->elts, (ring->nbElt - split) * sizeof(void*));
+
+  free(ring->elts);
+  ring->elts = elts;
+  ring->mask = capacity - 1;
+  ring->head = 0;
+  ring->tail = ring->nbElt;
+}
+
+ringHead*             ringCreate(unsigned int                capacity)
+{
+  ringHead*           result;
+  unsigned int        size;
+
+  if (!capacity)
+    capacity = RING_DEFAULT_CAPACITY;
+
+  for (size = 1; size < capacity; size <<= 1)
+    if (!(size << 1))
+      errx(EXIT_FAILURE, "ERROR: Ring capacity overflow");
+
+  if (!(result = malloc(sizeof(ringHead))))
+    errx(EXIT_FAILURE, "ERROR: Cannot allocate memory for ring head");
+
+  memset(result, 0, sizeof(ringHead));
+
+  if (!(result->elts = malloc(size * sizeof(void*))))
+    errx(EXIT_FAILURE, "ERROR: Cannot allocate memory for ring elements");
+
+  result->mask = size - 1;
+
+  return result;
+}
+
+int                   ringAdd(ringHead*                      ring,
+                              void*                          elt)
+{
+  if (!ring)
+    errx(EXIT_FAILURE, "ERROR: NULL ring");
+
+  if (ring->nbElt > ring->mask) /* Full */
+    ringGrow(ring);
+
+  ring->elts[ring->tail & ring->mask] = elt;
+  ring->tail  += 1;
+  ring->nbElt += 1;
+
+  return 1;
+}
+
+void*                 ringRemove(ringHead*                   ring)
+{
+  void*               result;
+
+  if (!ring)
+    errx(EXIT_FAILURE, "ERROR: NULL ring");
+
+  if (!ring->nbElt) /* No element */
+    return NULL;
+
+  result       = ring->elts[ring->head & ring->mask];
+  ring->head  += 1;
+  ring->nbElt -= 1;
+
+  return result;
+}
+
+void*                 ringFirst(ringHead*                    ring)
+{
+  if (!ring)
+    errx(EXIT_FAILURE, "ERROR: NULL ring");
+
+  if (!ring->nbElt) /* No element */
+    return NULL;
+
+  return ring->elts[ring->head & ring->mask];
+}
+
+void                  ringFree(ringHead*                     ring)
+{
+  if (!ring)
+    errx(EXIT_FAILURE, "ERROR: NULL ring");
+
+  free(ring->elts);
+
+  memset(ring, 0, sizeof(ringHead));
+  free(ring);
+}
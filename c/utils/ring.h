@@ -0,0 +1,74 @@
+#ifndef UTILS__RING_H_
+# define UTILS__RING_H_
+
+/**
+ ** Defines
+ */
+# define RING_DEFAULT_CAPACITY           64
+
+/**
+ ** Structure
+ */
+typedef struct                   ringHead
+{
+  void**                         elts;
+  unsigned int                   mask;
+  unsigned int                   head;
+  unsigned int                   tail;
+  unsigned int                   nbElt;
+}                                ringHead;
+
+
+/**
+ ** Methods
+ */
+
+/**
+ ** Create a new ring queue object.
+ ** The capacity is rounded up to the next power of two and doubles
+ ** whenever the ring is full.
+ **
+ ** \param  capacity    Initial capacity, RING_DEFAULT_CAPACITY if 0.
+ **
+ ** \return An initialized ring structure or NULL.
+ */
+ringHead*             ringCreate(unsigned int                capacity);
+
+/**
+ ** Add a new element to an existing ring queue.
+ **
+ ** \param  ring        The ring object.
+ ** \param  elt         The element to insert.
+ **
+ ** \return 1 if ok, else 0.
+ */
+int                   ringAdd(ringHead*                      ring,
+                              void*                          elt);
+
+/**
+ ** Remove and return the older element in the ring queue.
+ **
+ ** \param  ring        The ring object.
+ **
+ ** \return The older object in the ring queue.
+ */
+void*                 ringRemove(ringHead*                   ring);
+
+/**
+ ** Return the older element in the ring queue.
+ **
+ ** \param  ring        The ring object.
+ **
+ ** \return The older object in the ring queue.
+ */
+void*                 ringFirst(ringHead*                    ring);
+
+/**
+ ** Free a ring queue object properly
+ **
+ ** \param  ring        The ring object.
+ */
+void                  ringFree(ringHead*                     ring);
+
+
+#endif /* UTILS__RING_H_ */
@@ -0,0 +1,132 @@
+#include "spsc.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <assert.h>
+#include <pthread.h>
+#include <sched.h>
+
+#define NB_TRANSFER   2000000
+#define BATCH_SIZE    16
+
+static void*          producer(void*                         arg)
+{
+  spscHead*           spsc = arg;
+  void*               batch[BATCH_SIZE];
+  uintptr_t           next = 1;
+  unsigned int        nb;
+  unsigned int        i;
+
+  while (next <= NB_TRANSFER)
+  {
+    if (next & 1) /* Single element */
+    {
+      if (spscAdd(spsc, (void*) next))
+        ++next;
+      else
+        sched_yield();
+      continue;
+    }
+
+    /* Batch, possibly partially accepted */
+    for (nb = 0; (nb < BATCH_SIZE) && (next + nb <= NB_TRANSFER); ++nb)
+      batch[nb] = (void*) (next + nb);
+
+    for (i = 0; i < nb; )
+      if (!(i += spscAddBatch(spsc, batch + i, nb - i)))
+        sched_yield();
+    next += nb;
+  }
+
+  return NULL;
+}
+
+int                   main(void)
+{
+  spscHead*           spsc;
+  pthread_t           thread;
+  void*               batch[BATCH_SIZE];
+  uintptr_t           expected;
+  unsigned int        nb;
+  unsigned int        i;
+  int                 i1 = 1;
+  int                 i2 = 2;
+  int                 i3 = 3;
+  int                 i4 = 4;
+
+  /*
+   * Test 1
+   */
+
+  /* Create spsc */
+  assert(NULL != (spsc = spscCreate(3)));
+  assert(3    == spsc->mask);                   /* Rounded up to 4 */
+
+  /* Fill the spsc */
+  assert(1    == (spscAdd(spsc, &i1)));         /* Insert 1 */
+  assert(1    == (spscAdd(spsc, &i2)));         /* Insert 2 */
+  assert(1    == (spscAdd(spsc, &i3)));         /* Insert 3 */
+  assert(1    == (spscAdd(spsc, &i4)));         /* Insert 4 */
+  assert(0    == (spscAdd(spsc, &i1)));         /* Full */
+
+  /* Check the spsc */
+  assert(1    == (*(int*)spscFirst(spsc)));     /* Check  1 */
+  assert(1    == (*(int*)spscRemove(spsc)));    /* Remove 1 */
+  assert(2    == (*(int*)spscRemove(spsc)));    /* Remove 2 */
+
+  /* Batches are cut to the available room */
+  batch[0] = &i1;
+  batch[1] = &i2;
+  batch[2] = &i3;
+  assert(2    == spscAddBatch(spsc, batch, 3)); /* Insert 1, 2 */
+  assert(4    == spscRemoveBatch(spsc, batch, BATCH_SIZE));
+  assert(3    == *(int*)batch[0]);              /* Remove 3 */
+  assert(4    == *(int*)batch[1]);              /* Remove 4 */
+  assert(1    == *(int*)batch[2]);              /* Remove 1 */
+  assert(2    == *(int*)batch[3]);              /* Remove 2 */
+
+  assert(NULL == (spscFirst(spsc)));            /* Check empty    */
+  assert(NULL == (spscRemove(spsc)));           /* Spsc is empty  */
+  assert(0    == spscRemoveBatch(spsc, batch, BATCH_SIZE));
+
+  /* Clear the spsc */
+  spscFree(spsc);
+
+  printf("Spsc: Test1 success!\n");
+
+  /*
+   * Test 2
+   */
+
+  /* Two threads through a small ring so it wraps and fills constantly */
+  assert(NULL != (spsc = spscCreate(64)));
+  assert(0    == pthread_create(&thread, NULL, producer, spsc));
+
+  for (expected = 1; expected <= NB_TRANSFER; )
+  {
+    if (expected & 1) /* Single element */
+    {
+      if (!!(batch[0] = spscRemove(spsc)))
+        assert(expected++ == (uintptr_t) batch[0]);
+      else
+        sched_yield();
+      continue;
+    }
+
+    if (!(nb = spscRemoveBatch(spsc, batch, BATCH_SIZE)))
+      sched_yield();
+    for (i = 0; i < nb; ++i)
+      assert(expected++ == (uintptr_t) batch[i]);     /* Strict order */
+  }
+
+  assert(0    == pthread_join(thread, NULL));
+  assert(NULL == (spscRemove(spsc)));           /* Nothing extra */
+
+  /* Clear the spsc */
+  spscFree(spsc);
+
+  printf("Spsc: Test2 success!\n");
+
+  return 0;
+}
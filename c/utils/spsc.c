@@ -0,0 +1,187 @@
+#include "spsc.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <err.h>
+
+
+spscHead*             spscCreate(unsigned int                capacity)
+{
+  spscHead*           result;
+  unsigned int        size;
+
+  if (!capacity)
+    capacity = SPSC_DEFAULT_CAPACITY;
+
+  for (size = 1; size < capacity; size <<= 1)
+    if (!(size << 1))
+      errx(EXIT_FAILURE, "ERROR: Spsc capacity overflow");
+
+  if (!!posix_memalign((void**) &result, SPSC_CACHE_LINE, sizeof(spscHead)))
+    errx(EXIT_FAILURE, "ERROR: Cannot allocate memory for spsc head");
+
+  memset(result, 0, sizeof(spscHead));
+
+  if (!(result->elts = malloc(size * sizeof(void*))))
+    errx(EXIT_FAILURE, "ERROR: Cannot allocate memory for spsc elements");
+
+  result->mask = size - 1;
+  atomic_init(&result->head, 0);
+  atomic_init(&result->tail, 0);
+
+  return result;
+}
+
+/*
+ * Number of free slots seen by the producer, refreshing its copy of the
+ * consumer index only when the cached one says there is not enough room.
+ */
+static unsigned int   spscRoom(spscHead*                     spsc,
+                               unsigned int                  tail,
+                               unsigned int                  wanted)
+{
+  unsigned int        room;
+
+  room = spsc->mask + 1 - (tail - spsc->cachedHead);
+  if (room >= wanted)
+    return room;
+
+  spsc->cachedHead = atomic_load_explicit(&spsc->head, memory_order_acquire);
+
+  return spsc->mask + 1 - (tail - spsc->cachedHead);
+}
+
+/*
+ * Number of ready elements seen by the consumer, refreshing its copy of the
+ * producer index only when the cached one says there is not enough.
+ */
+static unsigned int   spscReady(spscHead*                    spsc,
+                                unsigned int                 head,
+                                unsigned int                 wanted)
+{
+  unsigned int        ready;
+
+  ready = spsc->cachedTail - head;
+  if (ready >= wanted)
+    return ready;
+
+  spsc->cachedTail = atomic_load_explicit(&spsc->tail, memory_order_acquire);
+
+  return spsc->cachedTail - head;
+}
+
+int                   spscAdd(spscHead*                      spsc,
+                              void*                          elt)
+{
+  unsigned int        tail;
+
+  if (!spsc)
+    errx(EXIT_FAILURE, "ERROR: NULL spsc");
+
+  tail = atomic_load_explicit(&spsc->tail, memory_order_relaxed);
+
+  if (!spscRoom(spsc, tail, 1)) /* Full */
+    return 0;
+
+  spsc->elts[tail & spsc->mask] = elt;
+  atomic_store_explicit(&spsc->tail, tail + 1, memory_order_release);
+
+  return 1;
+}
+
+unsigned int          spscAddBatch(spscHead*                 spsc,
+                                   void**                    elts,
+                                   unsigned int              nbElt)
+{
+  unsigned int        tail;
+  unsigned int        room;
+  unsigned int        i;
+
+  if (!spsc)
+    errx(EXIT_FAILURE, "ERROR: NULL spsc");
+
+  tail = atomic_load_explicit(&spsc->tail, memory_order_relaxed);
+
+  if ((room = spscRoom(spsc, tail, nbElt)) < nbElt)
+    nbElt = room;
+
+  for (i = 0; i < nbElt; ++i)
+    spsc->elts[(tail + i) & spsc->mask] = elts[i];
+
+  /* One release store publishes the whole batch */
+  if (!!nbElt)
+    atomic_store_explicit(&spsc->tail, tail + nbElt, memory_order_release);
+
+  return nbElt;
+}
+
+void*                 spscRemove(spscHead*                   spsc)
+{
+  void*               result;
+  unsigned int        head;
+
+  if (!spsc)
+    errx(EXIT_FAILURE, "ERROR: NULL spsc");
+
+  head = atomic_load_explicit(&spsc->head, memory_order_relaxed);
+
+  if (!spscReady(spsc, head, 1)) /* No element */
+    return NULL;
+
+  result = spsc->elts[head & spsc->mask];
+  atomic_store_explicit(&spsc->head, head + 1, memory_order_release);
+
+  return result;
+}
+
+unsigned int          spscRemoveBatch(spscHead*              spsc,
+                                      void**                 out,
+                                      unsigned int           max)
+{
+  unsigned int        head;
+  unsigned int        ready;
+  unsigned int        i;
+
+  if (!spsc)
+    errx(EXIT_FAILURE, "ERROR: NULL spsc");
+
+  head = atomic_load_explicit(&spsc->head, memory_order_relaxed);
+
+  if ((ready = spscReady(spsc, head, max)) < max)
+    max = ready;
+
+  for (i = 0; i < max; ++i)
+    out[i] = spsc->elts[(head + i) & spsc->mask];
+
+  /* One release store gives every slot back to the producer */
+  if (!!max)
+    atomic_store_explicit(&spsc->head, head + max, memory_order_release);
+
+  return max;
+}
+
+void*                 spscFirst(spscHead*                    spsc)
+{
+  unsigned int        head;
+
+  if (!spsc)
+    errx(EXIT_FAILURE, "ERROR: NULL spsc");
+
+  head = atomic_load_explicit(&spsc->head, memory_order_relaxed);
+
+  if (!spscReady(spsc, head, 1)) /* No element */
+    return NULL;
+
+  return spsc->elts[head & spsc->mask];
+}
+
+void                  spscFree(spscHead*                     spsc)
+{
+  if (!spsc)
+    errx(EXIT_FAILURE, "ERROR: NULL spsc");
+
+  free(spsc->elts);
+
+  memset(spsc, 0, sizeof(spscHead));
+  free(spsc);
+}
@@ -0,0 +1,113 @@
+#ifndef UTILS__SPSC_H_
+# define UTILS__SPSC_H_
+
+# include <stdatomic.h>
+
+/**
+ ** Defines
+ */
+# define SPSC_CACHE_LINE                 64
+# define SPSC_DEFAULT_CAPACITY           1024
+
+/**
+ ** Structure
+ **
+ ** The producer only writes tail and the consumer only writes head. Each
+ ** index lives on its own cache line next to the cached copy of the other
+ ** side, so the line only bounces when a side runs out of cached room.
+ */
+typedef struct                   spscHead
+{
+  _Alignas(SPSC_CACHE_LINE)
+  atomic_uint                    tail;
+  unsigned int                   cachedHead;
+
+  _Alignas(SPSC_CACHE_LINE)
+  atomic_uint                    head;
+  unsigned int                   cachedTail;
+
+  _Alignas(SPSC_CACHE_LINE)
+  void**                         elts;
+  unsigned int                   mask;
+}                                spscHead;
+
+
+/**
+ ** Methods
+ */
+
+/**
+ ** Create a new single producer / single consumer queue object.
+ ** The capacity is rounded up to the next power of two and never grows.
+ **
+ ** \param  capacity    Capacity, SPSC_DEFAULT_CAPACITY if 0.
+ **
+ ** \return An initialized spsc structure or NULL.
+ */
+spscHead*             spscCreate(unsigned int                capacity);
+
+/**
+ ** Add a new element to the queue. Producer thread only.
+ **
+ ** \param  spsc        The spsc object.
+ ** \param  elt         The element to insert, must not be NULL.
+ **
+ ** \return 1 if ok, 0 if the queue is full.
+ */
+int                   spscAdd(spscHead*                      spsc,
+                              void*                          elt);
+
+/**
+ ** Add up to nbElt elements and publish them at once. Producer thread only.
+ **
+ ** \param  spsc        The spsc object.
+ ** \param  elts        The elements to insert, must not be NULL.
+ ** \param  nbElt       Number of elements in elts.
+ **
+ ** \return The number of inserted elements.
+ */
+unsigned int          spscAddBatch(spscHead*                 spsc,
+                                   void**                    elts,
+                                   unsigned int              nbElt);
+
+/**
+ ** Remove and return the older element in the queue. Consumer thread only.
+ **
+ ** \param  spsc        The spsc object.
+ **
+ ** \return The older object in the queue, NULL if empty.
+ */
+void*                 spscRemove(spscHead*                   spsc);
+
+/**
+ ** Remove up to max elements and release their slots at once.
+ ** Consumer thread only.
+ **
+ ** \param  spsc        The spsc object.
+ ** \param  out         Array receiving the removed elements.
+ ** \param  max         Size of out.
+ **
+ ** \return The number of removed elements.
+ */
+unsigned int          spscRemoveBatch(spscHead*              spsc,
+                                      void**                 out,
+                                      unsigned int           max);
+
+/**
+ ** Return the older element in the queue. Consumer thread only.
+ **
+ ** \param  spsc        The spsc object.
+ **
+ ** \return The older object in the queue, NULL if empty.
+ */
+void*                 spscFirst(spscHead*                    spsc);
+
+/**
+ ** Free a spsc object properly. No thread may use it anymore.
+ **
+ ** \param  spsc        The spsc object.
+ */
+void                  spscFree(spscHead*                     spsc);
+
+
+#endif /* UTILS__SPSC_H_ */
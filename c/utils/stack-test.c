@@ -83,5 +83,33 @@ int                   main(void)
 
   printf("Stack: Test2 success!\n");
 
+  /*
+   * Test 3
+   */
+
+  /* Create pooled stack */
+  assert(NULL != (stack = stackCreatePooled(2)));
+
+  /* Fill the stack past the first slab */
+  assert(1    == (stackAdd(stack, &i1)));      /* Insert 1 */
+  assert(1    == (stackAdd(stack, &i2)));      /* Insert 2 */
+  assert(1    == (stackAdd(stack, &i3)));      /* Insert 3 */
+  assert(2    == stack->pool->nbSlab);         /* Second slab */
+
+  /* Check the stack */
+  assert(3    == (*(int*)stackRemove(stack))); /* Remove 3 */
+  assert(2    == (*(int*)stackRemove(stack))); /* Remove 2 */
+  assert(1    == (stackAdd(stack, &i4)));      /* Insert 4 */
+  assert(1    == (stackAdd(stack, &i2)));      /* Insert 2 */
+  assert(2    == stack->pool->nbSlab);         /* Nodes are recycled */
+
+  assert(2    == (*(int*)stackRemove(stack))); /* Remove 2 */
+  assert(4    == (*(int*)stackRemove(stack))); /* Remove 4 */
+
+  /* Clear a non empty stack */
+  stackFree(stack);
+
+  printf("Stack: Test3 success!\n");
+
   return 0;
 }
@@ -5,6 +5,28 @@
 #include <err.h>
 
 
+static stackElt*      stackEltAlloc(stackHead*               stack)
+{
+  stackElt*           result;
+
+  if (!!stack->pool)
+    return poolAlloc(stack->pool);
+
+  if (!(result = malloc(sizeof(stackElt))))
+    errx(EXIT_FAILURE, "ERROR: Cannot allocate memory for stack element");
+
+  return result;
+}
+
+static void           stackEltRelease(stackHead*             stack,
+                                      stackElt*              elt)
+{
+  if (!!stack->pool)
+    poolRelease(stack->pool, elt);
+  else
+    free(elt);
+}
+
 stackHead*            stackCreate(void)
 {
   stackHead*          result;
@@ -17,6 +39,16 @@ stackHead*            stackCreate(void)
   return result;
 }
 
+stackHead*            stackCreatePooled(unsigned int         initialCapacity)
+{
+  stackHead*          result;
+
+  result       = stackCreate();
+  result->pool = poolCreate(sizeof(stackElt), initialCapacity);
+
+  return result;
+}
+
 int                   stackAdd(stackHead*                    stack,
                                void*                         elt)
 {
@@ -25,8 +57,7 @@ int                   stackAdd(stackHead*                    stack,
   if (!stack)
     errx(EXIT_FAILURE, "ERROR: NULL stack");
 
-  if (!(newElt = malloc(sizeof(stackElt))))
-    errx(EXIT_FAILURE, "ERROR: Cannot allocate memory for stack element");
+  newElt = stackEltAlloc(stack);
 
   newElt->data  = elt;
   newElt->next  = stack->first;
@@ -51,7 +82,7 @@ void*                 stackRemove(stackHead*                 stack)
   result            = tmp->data;
   stack->first      = tmp->next;
   stack->nbElt     -= 1;
-  free(tmp);
+  stackEltRelease(stack, tmp);
 
   return result;
 }
@@ -63,6 +94,12 @@ void                  stackFree(stackHead*                   stack)
   if (!stack)
     errx(EXIT_FAILURE, "ERROR: NULL stack");
 
+  if (!!stack->pool) /* Slabs are released at once */
+  {
+    poolFree(stack->pool);
+    stack->first = NULL;
+  }
+
   while (!!stack->first)
   {
     tmp          = stack->first;
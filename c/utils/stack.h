@@ -1,6 +1,8 @@
 #ifndef UTILS__STACK_H_
 # define UTILS__STACK_H_
 
+# include "pool.h"
+
 /**
  ** Structure
  */
@@ -14,6 +16,7 @@ typedef struct                   stackHead
 {
   struct stackElt*               first;
   unsigned int                   nbElt;
+  struct poolHead*               pool;
 }                                stackHead;
 
 
@@ -28,6 +31,17 @@ typedef struct                   stackHead
  */
 stackHead*            stackCreate(void);
 
+/**
+ ** Create a new stack object whose elements are taken from a private pool.
+ ** Nodes are carved from slabs and recycled through the pool free list,
+ ** and stackFree() gives back whole slabs at once.
+ **
+ ** \param  initialCapacity Number of nodes per slab.
+ **
+ ** \return An initialized stack structure or NULL.
+ */
+stackHead*            stackCreatePooled(unsigned int         initialCapacity);
+
 /**
  ** Add a new element to an existing stack.
  **